@@ -539,11 +539,20 @@
  *   JSON format.
  *
  * Note that to use a specific format it must be available during compilation.
+ * For numeric telemetry, LwM2M CBOR is usually the most compact of these.
  *
  * The default value defined in CMake build scripts is
  * <c>AVS_COAP_FORMAT_NONE</c>.
  */
-#define ANJAY_DEFAULT_SEND_FORMAT AVS_COAP_FORMAT_NONE
+#if defined(CONFIG_ANJAY_DEFAULT_SEND_FORMAT_OMA_LWM2M_CBOR)
+#    define ANJAY_DEFAULT_SEND_FORMAT AVS_COAP_FORMAT_OMA_LWM2M_CBOR
+#elif defined(CONFIG_ANJAY_DEFAULT_SEND_FORMAT_SENML_CBOR)
+#    define ANJAY_DEFAULT_SEND_FORMAT AVS_COAP_FORMAT_SENML_CBOR
+#elif defined(CONFIG_ANJAY_DEFAULT_SEND_FORMAT_SENML_JSON)
+#    define ANJAY_DEFAULT_SEND_FORMAT AVS_COAP_FORMAT_SENML_JSON
+#else // CONFIG_ANJAY_DEFAULT_SEND_FORMAT_*
+#    define ANJAY_DEFAULT_SEND_FORMAT AVS_COAP_FORMAT_NONE
+#endif // CONFIG_ANJAY_DEFAULT_SEND_FORMAT_*
 
 /**
  * Optional Anjay modules.
@@ -781,7 +790,9 @@
  * <c>anjay_get_server_connection_status()</c> API and related
  * <c>anjay_server_connection_status_cb_t</c> callback.
  */
-/* #undef ANJAY_WITH_CONN_STATUS_API */
+#ifdef CONFIG_ANJAY_WITH_CONN_STATUS_API
+#    define ANJAY_WITH_CONN_STATUS_API
+#endif // CONFIG_ANJAY_WITH_CONN_STATUS_API
 
 /**
  * Enable support for /25 LwM2M Gateway Object.
@@ -790,7 +801,9 @@
  * Requires <c>ANJAY_WITH_CORE_PERSISTENCE</c> (commercial feature) to be
  * disabled.
  */
-/* #undef ANJAY_WITH_LWM2M_GATEWAY */
+#ifdef CONFIG_ANJAY_WITH_LWM2M_GATEWAY
+#    define ANJAY_WITH_LWM2M_GATEWAY
+#endif // CONFIG_ANJAY_WITH_LWM2M_GATEWAY
 
 /**@}*/
 
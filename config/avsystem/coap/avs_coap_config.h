@@ -135,7 +135,9 @@
  * NOTE: Enabling at least one transport is necessary for the library to be
  * useful.
  */
-#define WITH_AVS_COAP_TCP
+#ifdef CONFIG_WITH_AVS_COAP_TCP
+#    define WITH_AVS_COAP_TCP
+#endif // CONFIG_WITH_AVS_COAP_TCP
 
 /**
  * Enable support for OSCORE (RFC 8613).
@@ -145,7 +145,10 @@
  * If defined, custom implementation of conversion is used in
  * @c AVS_UINT64_AS_STRING instead of using @c snprintf .
  */
-/* #undef AVS_COMMONS_WITHOUT_64BIT_FORMAT_SPECIFIERS */
+#if defined(CONFIG_NEWLIB_NANO_FORMAT) || defined(CONFIG_LIBC_NEWLIB_NANO_FORMAT)
+#    define AVS_COMMONS_WITHOUT_64BIT_FORMAT_SPECIFIERS
+#endif // defined(CONFIG_NEWLIB_NANO_FORMAT) ||
+       // defined(CONFIG_LIBC_NEWLIB_NANO_FORMAT)
 
 /**
  * Set if printf implementation doesn't support floating-point numbers.
@@ -158,7 +161,13 @@
  * not intended to be 100% accurate. Rounding errors may occur - according to
  * empirical checks, they show up around the 16th significant decimal digit.
  */
-/* #undef AVS_COMMONS_WITHOUT_FLOAT_FORMAT_SPECIFIERS */
+#if defined(CONFIG_AVS_COMMONS_WITHOUT_FLOAT_FORMAT_SPECIFIERS) \
+        || defined(CONFIG_NEWLIB_NANO_FORMAT)                  \
+        || defined(CONFIG_LIBC_NEWLIB_NANO_FORMAT)
+#    define AVS_COMMONS_WITHOUT_FLOAT_FORMAT_SPECIFIERS
+#endif // defined(CONFIG_AVS_COMMONS_WITHOUT_FLOAT_FORMAT_SPECIFIERS) ||
+       // defined(CONFIG_NEWLIB_NANO_FORMAT) ||
+       // defined(CONFIG_LIBC_NEWLIB_NANO_FORMAT)
 /**@}*/
 
 /**
@@ -241,8 +250,15 @@
  *
  * This implementation is preferred over the spinlock-based one, but the POSIX
  * Threads library is normally available only in UNIX-like environments.
+ *
+ * If <c>CONFIG_ANJAY_ESP_IDF_COMPAT_THREADING_WITH_FREERTOS</c> is selected
+ * instead, none of the implementations is enabled, and the relevant symbols are
+ * provided by the native FreeRTOS implementation in the
+ * <c>src/compat/threading/freertos</c> directory of this component.
  */
-#define AVS_COMMONS_COMPAT_THREADING_WITH_PTHREAD
+#ifdef CONFIG_AVS_COMMONS_COMPAT_THREADING_WITH_PTHREAD
+#    define AVS_COMMONS_COMPAT_THREADING_WITH_PTHREAD
+#endif // CONFIG_AVS_COMMONS_COMPAT_THREADING_WITH_PTHREAD
 
 /**
  * Is the <c>pthread_condattr_setclock()</c> function available?
@@ -623,7 +639,10 @@
  * #endif
  * </code>
  */
-/* #undef AVS_COMMONS_WITH_EXTERNAL_LOG_LEVELS_HEADER */
+#ifdef CONFIG_AVS_COMMONS_WITH_EXTERNAL_LOG_LEVELS_HEADER
+#    define AVS_COMMONS_WITH_EXTERNAL_LOG_LEVELS_HEADER \
+        "avsystem/commons/avs_commons_log_levels.h"
+#endif // CONFIG_AVS_COMMONS_WITH_EXTERNAL_LOG_LEVELS_HEADER
 
 /**
  * Disable log level check in runtime. Allows to save at least 1.3kB of memory.
@@ -632,7 +651,9 @@
  * will not be available.
  *
  */
-/* #undef AVS_COMMONS_WITHOUT_LOG_CHECK_IN_RUNTIME */
+#ifdef CONFIG_AVS_COMMONS_WITHOUT_LOG_CHECK_IN_RUNTIME
+#    define AVS_COMMONS_WITHOUT_LOG_CHECK_IN_RUNTIME
+#endif // CONFIG_AVS_COMMONS_WITHOUT_LOG_CHECK_IN_RUNTIME
 /**@}*/
 
 /**
@@ -834,8 +855,14 @@
  *
  * Requires an operating environment that supports a clock_gettime() call
  * compatible with POSIX.
+ *
+ * If <c>CONFIG_ANJAY_ESP_IDF_AVS_TIME_WITH_ESP_TIMER</c> is selected instead,
+ * an implementation based on <c>esp_timer_get_time()</c> is provided by this
+ * component.
  */
-#define AVS_COMMONS_UTILS_WITH_POSIX_AVS_TIME
+#ifdef CONFIG_AVS_COMMONS_UTILS_WITH_POSIX_AVS_TIME
+#    define AVS_COMMONS_UTILS_WITH_POSIX_AVS_TIME
+#endif // CONFIG_AVS_COMMONS_UTILS_WITH_POSIX_AVS_TIME
 
 /**
  * Enable the default implementation of avs_malloc(), avs_free(), avs_calloc()
@@ -844,8 +871,14 @@
  *
  * You might disable this option if for any reason you need to use a custom
  * allocator.
+ *
+ * If <c>CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING</c> is enabled, this option
+ * is disabled, and an allocator that also collects usage statistics is
+ * provided by this component instead.
  */
-#define AVS_COMMONS_UTILS_WITH_STANDARD_ALLOCATOR
+#ifndef CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING
+#    define AVS_COMMONS_UTILS_WITH_STANDARD_ALLOCATOR
+#endif // CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING
 
 /**
  * Enable the alternate implementation of avs_malloc(), avs_free(), avs_calloc()
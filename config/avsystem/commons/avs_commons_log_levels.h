@@ -0,0 +1,83 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AVS_COMMONS_EXTERNAL_LOG_LEVELS_H
+#define AVS_COMMONS_EXTERNAL_LOG_LEVELS_H
+
+#include <sdkconfig.h>
+
+/*
+ * Compile-time log levels, used as AVS_COMMONS_WITH_EXTERNAL_LOG_LEVELS_HEADER.
+ * See the documentation of that macro in avs_commons_config.h for details.
+ */
+
+#if defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_TRACE)
+#    define AVS_LOG_LEVEL_DEFAULT TRACE
+#elif defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_DEBUG)
+#    define AVS_LOG_LEVEL_DEFAULT DEBUG
+#elif defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_INFO)
+#    define AVS_LOG_LEVEL_DEFAULT INFO
+#elif defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_WARNING)
+#    define AVS_LOG_LEVEL_DEFAULT WARNING
+#elif defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_ERROR)
+#    define AVS_LOG_LEVEL_DEFAULT ERROR
+#elif defined(CONFIG_AVS_LOG_LEVEL_DEFAULT_QUIET)
+#    define AVS_LOG_LEVEL_DEFAULT QUIET
+#endif // CONFIG_AVS_LOG_LEVEL_DEFAULT_*
+
+#if defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_TRACE)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay TRACE
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_DEBUG)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay DEBUG
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_INFO)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay INFO
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_WARNING)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay WARNING
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_ERROR)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay ERROR
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_QUIET)
+#    define AVS_LOG_LEVEL_FOR_MODULE_anjay QUIET
+#endif // CONFIG_AVS_LOG_LEVEL_FOR_MODULE_ANJAY_*
+
+#if defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_TRACE)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap TRACE
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_DEBUG)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap DEBUG
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_INFO)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap INFO
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_WARNING)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap WARNING
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_ERROR)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap ERROR
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_QUIET)
+#    define AVS_LOG_LEVEL_FOR_MODULE_coap QUIET
+#endif // CONFIG_AVS_LOG_LEVEL_FOR_MODULE_COAP_*
+
+#if defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_TRACE)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net TRACE
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_DEBUG)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net DEBUG
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_INFO)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net INFO
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_WARNING)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net WARNING
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_ERROR)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net ERROR
+#elif defined(CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_QUIET)
+#    define AVS_LOG_LEVEL_FOR_MODULE_net QUIET
+#endif // CONFIG_AVS_LOG_LEVEL_FOR_MODULE_NET_*
+
+#endif /* AVS_COMMONS_EXTERNAL_LOG_LEVELS_H */
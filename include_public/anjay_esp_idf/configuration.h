@@ -0,0 +1,112 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ANJAY_ESP_IDF_CONFIGURATION_H
+#define ANJAY_ESP_IDF_CONFIGURATION_H
+
+#include <avsystem/commons/avs_time.h>
+
+#include <avsystem/coap/udp.h>
+
+#include <anjay/core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file configuration.h
+ *
+ * Runtime parameters of Anjay, as configured in the Anjay menu of
+ * <c>menuconfig</c>. Options that do not correspond to compile-time flags of
+ * the libraries only take effect if the application passes the values
+ * returned by these functions to Anjay.
+ */
+
+#ifdef ANJAY_WITH_EVENT_LOOP
+/**
+ * Returns the value of <c>CONFIG_ANJAY_EVENT_LOOP_MAX_WAIT_TIME_MS</c>, to be
+ * passed as the <c>max_wait_time</c> argument of
+ * <c>anjay_event_loop_run()</c>.
+ *
+ * The event loop sleeps until a socket becomes readable or the next scheduled
+ * job is due, but never longer than this value. Jobs scheduled from other
+ * tasks (e.g. by <c>anjay_notify_changed()</c>) may only be noticed after that
+ * time, so lower values reduce the latency of such calls, while higher values
+ * reduce the number of idle wakeups of the Anjay task.
+ */
+avs_time_duration_t anjay_esp_idf_event_loop_max_wait_time(void);
+#endif // ANJAY_WITH_EVENT_LOOP
+
+/**
+ * Returns CoAP/UDP transmission parameters configured in the "CoAP transport
+ * configuration" menu of <c>menuconfig</c>, suitable for the
+ * <c>udp_tx_params</c> field of <c>anjay_configuration_t</c>:
+ *
+ * - <c>nstart</c> - maximum number of Confirmable exchanges that may be in
+ *   progress with a single server at the same time. With the default of 1, as
+ *   recommended by RFC 7252, each Notify or Send waits for the previous message
+ *   to be acknowledged, which limits throughput to about one message per round
+ *   trip time on high-latency links. Higher values should only be used if the
+ *   server and the network are known to handle them.
+ *
+ * - <c>ack_timeout</c> - initial retransmission timeout. avs_coap rejects
+ *   values lower than 1 second, as required by RFC 7252. Values larger than the
+ *   default of 2 seconds may be used on high-latency links such as NB-IoT,
+ *   where the round trip time may be close to or exceed ACK_TIMEOUT, to avoid
+ *   spurious retransmissions (visible in
+ *   <c>anjay_get_num_outgoing_retransmissions()</c>).
+ *
+ * - <c>ack_random_factor</c> - configured in percent, converted here to the
+ *   floating-point factor expected by avs_coap. The initial retransmission
+ *   timeout is chosen randomly between ACK_TIMEOUT and
+ *   ACK_TIMEOUT * ACK_RANDOM_FACTOR, and doubled after each retransmission.
+ *
+ * - <c>max_retransmit</c> - maximum number of retransmissions of a single
+ *   Confirmable message.
+ *
+ * @returns Pointer to a statically allocated structure.
+ */
+const avs_coap_udp_tx_params_t *anjay_esp_idf_udp_tx_params(void);
+
+/**
+ * Sets the fields of @p config that correspond to the options in the
+ * "CoAP transport configuration" menu of <c>menuconfig</c>:
+ *
+ * - <c>udp_tx_params</c> - set to @ref anjay_esp_idf_udp_tx_params.
+ *
+ * - <c>msg_cache_size</c> - if non-zero, responses sent over UDP are kept in a
+ *   cache of this size for EXCHANGE_LIFETIME. When the server retransmits a
+ *   request because the response was lost, the cached response is sent again
+ *   instead of calling the data model handlers once more - so e.g. an Execute
+ *   is not performed twice. 0 disables the cache.
+ * - <c>coap_tcp_request_timeout</c> - maximum time to wait for the response to
+ *   a request that has already been sent over TCP; the request is considered
+ *   failed if it does not arrive in time. It does not affect idle connections
+ *   and generates no traffic to keep them open. Left unchanged if CoAP over
+ *   TCP support is disabled.
+ *
+ * Other fields are left untouched, so this is intended to be called on an
+ * otherwise filled structure, right before passing it to <c>anjay_new()</c>.
+ *
+ * @param config Configuration to update.
+ */
+void anjay_esp_idf_configuration_fill(anjay_configuration_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANJAY_ESP_IDF_CONFIGURATION_H */
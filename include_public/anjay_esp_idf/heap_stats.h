@@ -0,0 +1,144 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANJAY_ESP_IDF_HEAP_STATS_H
+#define ANJAY_ESP_IDF_HEAP_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sdkconfig.h>
+
+#ifndef CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING
+#    error "anjay_esp_idf/heap_stats.h requires CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING to be enabled"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file heap_stats.h
+ *
+ * Statistics of heap memory allocated through <c>avs_malloc()</c> and related
+ * functions, i.e. by Anjay, avs_coap and avs_commons, as well as by
+ * application code that uses these functions.
+ *
+ * Only available if <c>CONFIG_ANJAY_ESP_IDF_WITH_HEAP_ACCOUNTING</c> is
+ * enabled.
+ */
+
+/**
+ * Subsystems that allocations are attributed to. Each of them corresponds to
+ * a group of source files, see <c>CMakeLists.txt</c>.
+ *
+ * A block is attributed to the subsystem that allocated it, even if it is
+ * reallocated or freed by another one.
+ *
+ * Attribution is based on the source file that calls <c>avs_malloc()</c>, so
+ * memory allocated by generic avs_commons helpers on behalf of their callers
+ * (e.g. <c>avs_strdup()</c>, <c>avs_buffer_create()</c>, membuf streams or
+ * avs_sched jobs) is charged to @ref ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS rather
+ * than to the subsystem that requested it. Macros that allocate in the caller
+ * (e.g. <c>AVS_LIST_NEW_ELEMENT()</c>) are attributed correctly.
+ */
+typedef enum {
+    /** Parts of Anjay not listed below, including its modules. */
+    ANJAY_ESP_IDF_HEAP_TAG_ANJAY,
+    /** Anjay data model core (<c>src/core/dm</c>). */
+    ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DM,
+    /** Anjay Information Reporting (<c>src/core/observe</c>). */
+    ANJAY_ESP_IDF_HEAP_TAG_ANJAY_OBSERVE,
+    /** Anjay downloader (<c>src/core/downloader</c>). */
+    ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DOWNLOADER,
+    /** avs_coap library. */
+    ANJAY_ESP_IDF_HEAP_TAG_AVS_COAP,
+    /** Networking and (D)TLS layer of avs_commons (<c>src/net</c>). */
+    ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_NET,
+    /** avs_persistence (<c>src/persistence</c>). */
+    ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_PERSISTENCE,
+    /** Other parts of avs_commons. */
+    ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS,
+    /**
+     * All other code, including the application and the ESP-IDF specific
+     * parts of this component.
+     */
+    ANJAY_ESP_IDF_HEAP_TAG_OTHER,
+    /** Number of tags; not a valid tag. */
+    ANJAY_ESP_IDF_HEAP_TAG_COUNT
+} anjay_esp_idf_heap_tag_t;
+
+typedef struct {
+    /** Number of bytes currently allocated. */
+    size_t current_bytes;
+    /** Highest value of @ref current_bytes since the last peak reset. */
+    size_t peak_bytes;
+    /** Number of blocks currently allocated. */
+    uint32_t current_blocks;
+    /** Total number of successful allocations, including reallocations. */
+    uint32_t num_allocations;
+    /** Total number of failed allocations. */
+    uint32_t num_failed_allocations;
+} anjay_esp_idf_heap_stats_t;
+
+/**
+ * Retrieves the heap usage statistics summed over all subsystems.
+ *
+ * Sizes are the sizes requested by the callers. They do not include the
+ * small header stored in front of each block, nor the padding added by the
+ * ESP-IDF heap implementation.
+ *
+ * The counters are updated without a common lock, so if other tasks allocate
+ * memory concurrently, the fields may come from slightly different moments.
+ *
+ * @param out_stats Structure to fill with the statistics.
+ */
+void anjay_esp_idf_heap_stats_get(anjay_esp_idf_heap_stats_t *out_stats);
+
+/**
+ * Retrieves the heap usage statistics of a single subsystem. See
+ * @ref anjay_esp_idf_heap_stats_get for details.
+ *
+ * @param tag       Subsystem to retrieve the statistics for.
+ *
+ * @param out_stats Structure to fill with the statistics.
+ *
+ * @returns 0 on success, or a negative value if @p tag is invalid.
+ */
+int anjay_esp_idf_heap_stats_get_for_tag(
+        anjay_esp_idf_heap_tag_t tag, anjay_esp_idf_heap_stats_t *out_stats);
+
+/**
+ * Resets the peak usage to the current usage, for all subsystems and for the
+ * totals.
+ */
+void anjay_esp_idf_heap_stats_reset_peak(void);
+
+/**
+ * Prints the current statistics of each subsystem and the totals as
+ * INFO-level log messages, using the ESP-IDF logging facilities.
+ *
+ * If <c>CONFIG_ANJAY_ESP_IDF_HEAP_STATS_LOG_INTERVAL_S</c> is non-zero, this is
+ * additionally called periodically from an esp_timer, started on the first
+ * allocation.
+ */
+void anjay_esp_idf_heap_stats_log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANJAY_ESP_IDF_HEAP_STATS_H */
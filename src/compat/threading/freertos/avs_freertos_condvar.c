@@ -0,0 +1,154 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <avsystem/commons/avs_condvar.h>
+#include <avsystem/commons/avs_memory.h>
+#include <avsystem/commons/avs_mutex.h>
+#include <avsystem/commons/avs_time.h>
+
+/*
+ * Index 0 is used by FreeRTOS itself (e.g. stream buffers) and by most
+ * application code, so the last entry of the array is used instead.
+ */
+#define NOTIFY_INDEX (configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)
+
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 2
+#    error "CONFIG_FREERTOS_TASK_NOTIFICATION_ARRAY_ENTRIES must be at least 2"
+#endif
+
+/*
+ * Each waiting task enqueues a node allocated on its own stack and sleeps on
+ * its task notification. The list is only ever accessed with list_lock held,
+ * and a waiter does not return before it has taken list_lock again, so the
+ * nodes never outlive their stack frames.
+ */
+typedef struct condvar_waiter {
+    struct condvar_waiter *next;
+    TaskHandle_t task;
+} condvar_waiter_t;
+
+struct avs_condvar {
+    StaticSemaphore_t list_lock_storage;
+    SemaphoreHandle_t list_lock;
+    condvar_waiter_t *first_waiter;
+};
+
+int avs_condvar_create(avs_condvar_t **out_condvar) {
+    assert(!*out_condvar);
+
+    *out_condvar = (avs_condvar_t *) avs_calloc(1, sizeof(avs_condvar_t));
+    if (!*out_condvar) {
+        return -1;
+    }
+    (*out_condvar)->list_lock =
+            xSemaphoreCreateMutexStatic(&(*out_condvar)->list_lock_storage);
+    assert((*out_condvar)->list_lock);
+    return 0;
+}
+
+int avs_condvar_notify_all(avs_condvar_t *condvar) {
+    xSemaphoreTake(condvar->list_lock, portMAX_DELAY);
+    for (condvar_waiter_t *waiter = condvar->first_waiter; waiter;
+         waiter = waiter->next) {
+        xTaskNotifyGiveIndexed(waiter->task, NOTIFY_INDEX);
+    }
+    condvar->first_waiter = NULL;
+    xSemaphoreGive(condvar->list_lock);
+    return 0;
+}
+
+static TickType_t ticks_until(avs_time_monotonic_t deadline) {
+    if (!avs_time_monotonic_valid(deadline)) {
+        return portMAX_DELAY;
+    }
+    int64_t remaining_ms;
+    if (avs_time_duration_to_scalar(
+                &remaining_ms, AVS_TIME_MS,
+                avs_time_monotonic_diff(deadline, avs_time_monotonic_now()))
+            || remaining_ms < 0) {
+        return 0;
+    }
+    if ((uint64_t) remaining_ms
+            >= (uint64_t) (portMAX_DELAY - 1) * 1000 / configTICK_RATE_HZ) {
+        return portMAX_DELAY - 1;
+    }
+    // the current tick period is already partially elapsed, so one more tick
+    // is needed for the wait not to end before the deadline
+    return (TickType_t) ((uint64_t) remaining_ms * configTICK_RATE_HZ / 1000)
+           + 1;
+}
+
+int avs_condvar_wait(avs_condvar_t *condvar,
+                     avs_mutex_t *mutex,
+                     avs_time_monotonic_t deadline) {
+    condvar_waiter_t waiter = {
+        .task = xTaskGetCurrentTaskHandle()
+    };
+
+    xSemaphoreTake(condvar->list_lock, portMAX_DELAY);
+    // discard any notification left over from a previous wait
+    ulTaskNotifyTakeIndexed(NOTIFY_INDEX, pdTRUE, 0);
+    waiter.next = condvar->first_waiter;
+    condvar->first_waiter = &waiter;
+    xSemaphoreGive(condvar->list_lock);
+
+    int result = avs_mutex_unlock(mutex);
+    if (!result) {
+        ulTaskNotifyTakeIndexed(NOTIFY_INDEX, pdTRUE, ticks_until(deadline));
+    }
+
+    bool notified = true;
+    xSemaphoreTake(condvar->list_lock, portMAX_DELAY);
+    for (condvar_waiter_t **waiter_ptr = &condvar->first_waiter; *waiter_ptr;
+         waiter_ptr = &(*waiter_ptr)->next) {
+        if (*waiter_ptr == &waiter) {
+            *waiter_ptr = waiter.next;
+            notified = false;
+            break;
+        }
+    }
+    if (notified) {
+        // the notification might have been given after the timeout expired
+        ulTaskNotifyTakeIndexed(NOTIFY_INDEX, pdTRUE, 0);
+    }
+    xSemaphoreGive(condvar->list_lock);
+
+    if (result) {
+        return result;
+    }
+    if (avs_mutex_lock(mutex)) {
+        return -1;
+    }
+    return notified ? 0 : AVS_CONDVAR_TIMEOUT;
+}
+
+void avs_condvar_cleanup(avs_condvar_t **condvar) {
+    if (!*condvar) {
+        return;
+    }
+    assert(!(*condvar)->first_waiter);
+    vSemaphoreDelete((*condvar)->list_lock);
+    avs_free(*condvar);
+    *condvar = NULL;
+}
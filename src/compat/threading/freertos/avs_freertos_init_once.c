@@ -0,0 +1,48 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <avsystem/commons/avs_init_once.h>
+
+static char INIT_IN_PROGRESS;
+static char INIT_DONE;
+
+int avs_init_once(avs_init_once_handle_t *handle,
+                  avs_init_once_func_t *func,
+                  void *func_arg) {
+    while (true) {
+        void *expected = NULL;
+        if (__atomic_compare_exchange_n(handle, &expected, &INIT_IN_PROGRESS,
+                                        false, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_ACQUIRE)) {
+            int result = func(func_arg);
+            // on failure, the handle is reset so that the next call retries
+            __atomic_store_n(handle, result ? NULL : &INIT_DONE,
+                             __ATOMIC_RELEASE);
+            return result;
+        }
+        if (expected == &INIT_DONE) {
+            return 0;
+        }
+        // another task is running func; yield until it finishes
+        vTaskDelay(1);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <assert.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <avsystem/commons/avs_memory.h>
+#include <avsystem/commons/avs_mutex.h>
+
+/*
+ * The semaphore control block is embedded in the mutex object, so that
+ * creating a mutex requires a single heap allocation and no further
+ * allocations are made by FreeRTOS itself.
+ */
+struct avs_mutex {
+    StaticSemaphore_t storage;
+    SemaphoreHandle_t handle;
+};
+
+int avs_mutex_create(avs_mutex_t **out_mutex) {
+    assert(!*out_mutex);
+
+    *out_mutex = (avs_mutex_t *) avs_calloc(1, sizeof(avs_mutex_t));
+    if (!*out_mutex) {
+        return -1;
+    }
+    (*out_mutex)->handle = xSemaphoreCreateMutexStatic(&(*out_mutex)->storage);
+    assert((*out_mutex)->handle);
+    return 0;
+}
+
+int avs_mutex_lock(avs_mutex_t *mutex) {
+    return xSemaphoreTake(mutex->handle, portMAX_DELAY) == pdTRUE ? 0 : -1;
+}
+
+int avs_mutex_try_lock(avs_mutex_t *mutex) {
+    return xSemaphoreTake(mutex->handle, 0) == pdTRUE ? 0 : 1;
+}
+
+int avs_mutex_unlock(avs_mutex_t *mutex) {
+    return xSemaphoreGive(mutex->handle) == pdTRUE ? 0 : -1;
+}
+
+void avs_mutex_cleanup(avs_mutex_t **mutex) {
+    if (!*mutex) {
+        return;
+    }
+    vSemaphoreDelete((*mutex)->handle);
+    avs_free(*mutex);
+    *mutex = NULL;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sdkconfig.h>
+
+#include <anjay_esp_idf/configuration.h>
+
+#ifdef ANJAY_WITH_EVENT_LOOP
+avs_time_duration_t anjay_esp_idf_event_loop_max_wait_time(void) {
+    return avs_time_duration_from_scalar(
+            CONFIG_ANJAY_EVENT_LOOP_MAX_WAIT_TIME_MS, AVS_TIME_MS);
+}
+#endif // ANJAY_WITH_EVENT_LOOP
+
+static const avs_coap_udp_tx_params_t UDP_TX_PARAMS = {
+    .ack_timeout = { CONFIG_ANJAY_COAP_UDP_ACK_TIMEOUT_MS / 1000,
+                     (CONFIG_ANJAY_COAP_UDP_ACK_TIMEOUT_MS % 1000) * 1000000 },
+    .ack_random_factor =
+            CONFIG_ANJAY_COAP_UDP_ACK_RANDOM_FACTOR_PERCENT / 100.0,
+    .max_retransmit = CONFIG_ANJAY_COAP_UDP_MAX_RETRANSMIT,
+    .nstart = CONFIG_ANJAY_COAP_UDP_NSTART
+};
+
+const avs_coap_udp_tx_params_t *anjay_esp_idf_udp_tx_params(void) {
+    return &UDP_TX_PARAMS;
+}
+
+void anjay_esp_idf_configuration_fill(anjay_configuration_t *config) {
+    config->udp_tx_params = anjay_esp_idf_udp_tx_params();
+    config->msg_cache_size = CONFIG_ANJAY_MSG_CACHE_SIZE;
+#ifdef CONFIG_ANJAY_COAP_TCP_REQUEST_TIMEOUT_S
+    config->coap_tcp_request_timeout = avs_time_duration_from_scalar(
+            CONFIG_ANJAY_COAP_TCP_REQUEST_TIMEOUT_S, AVS_TIME_S);
+#endif // CONFIG_ANJAY_COAP_TCP_REQUEST_TIMEOUT_S
+}
@@ -0,0 +1,323 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sdkconfig.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <avsystem/commons/avs_defs.h>
+#include <avsystem/commons/avs_memory.h>
+
+#include <anjay_esp_idf/heap_stats.h>
+
+static const char *TAG = "anjay_heap";
+
+/*
+ * Each block is preceded by a header that holds its requested size and the
+ * tag it has been accounted to, so that avs_free() and avs_realloc() can
+ * update the right counters without querying the heap. The header is padded
+ * to the alignment of max_align_t, so the alignment of the returned pointers
+ * is the same as that of the underlying malloc().
+ */
+typedef struct {
+    uint32_t size;
+    uint32_t tag;
+} block_header_t;
+
+#define HEADER_SIZE                                            \
+    ((sizeof(block_header_t) + AVS_ALIGNOF(max_align_t) - 1) \
+     / AVS_ALIGNOF(max_align_t) * AVS_ALIGNOF(max_align_t))
+
+/*
+ * Counters are updated with relaxed atomic operations instead of a lock, as
+ * they are independent of each other; the last entry holds the totals.
+ */
+static anjay_esp_idf_heap_stats_t g_stats[ANJAY_ESP_IDF_HEAP_TAG_COUNT + 1];
+
+static void update_peak(size_t *peak, size_t current) {
+    size_t old_peak = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while (current > old_peak
+           && !__atomic_compare_exchange_n(peak, &old_peak, current, true,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED)) {
+    }
+}
+
+static void account_allocation(anjay_esp_idf_heap_stats_t *stats,
+                               size_t size,
+                               bool new_block) {
+    update_peak(&stats->peak_bytes,
+                __atomic_add_fetch(&stats->current_bytes, size,
+                                   __ATOMIC_RELAXED));
+    if (new_block) {
+        __atomic_add_fetch(&stats->current_blocks, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_add_fetch(&stats->num_allocations, 1, __ATOMIC_RELAXED);
+}
+
+static void account_release(anjay_esp_idf_heap_stats_t *stats,
+                            size_t size,
+                            bool whole_block) {
+    __atomic_sub_fetch(&stats->current_bytes, size, __ATOMIC_RELAXED);
+    if (whole_block) {
+        __atomic_sub_fetch(&stats->current_blocks, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void account(anjay_esp_idf_heap_tag_t tag,
+                    size_t freed_bytes,
+                    size_t allocated_bytes,
+                    bool block_freed,
+                    bool block_allocated) {
+    anjay_esp_idf_heap_stats_t *stats[] = {
+        &g_stats[tag], &g_stats[ANJAY_ESP_IDF_HEAP_TAG_COUNT]
+    };
+    for (size_t i = 0; i < AVS_ARRAY_SIZE(stats); ++i) {
+        if (freed_bytes || block_freed) {
+            account_release(stats[i], freed_bytes, block_freed);
+        }
+        if (allocated_bytes || block_allocated) {
+            account_allocation(stats[i], allocated_bytes, block_allocated);
+        }
+    }
+}
+
+static void account_failure(anjay_esp_idf_heap_tag_t tag) {
+    __atomic_add_fetch(&g_stats[tag].num_failed_allocations, 1,
+                       __ATOMIC_RELAXED);
+    __atomic_add_fetch(
+            &g_stats[ANJAY_ESP_IDF_HEAP_TAG_COUNT].num_failed_allocations, 1,
+            __ATOMIC_RELAXED);
+}
+
+#if CONFIG_ANJAY_ESP_IDF_HEAP_STATS_LOG_INTERVAL_S > 0
+static void log_timer_callback(void *arg) {
+    (void) arg;
+    anjay_esp_idf_heap_stats_log();
+}
+
+/*
+ * There is no initialization function that the application would have to
+ * call, so the periodic log is started lazily, on the first allocation.
+ * esp_timer_create() allocates with the system allocator, not avs_malloc().
+ */
+static void ensure_log_timer_started(void) {
+    static bool started;
+    if (__atomic_load_n(&started, __ATOMIC_RELAXED)
+            || __atomic_exchange_n(&started, true, __ATOMIC_RELAXED)) {
+        return;
+    }
+    const esp_timer_create_args_t args = {
+        .callback = log_timer_callback,
+        .name = "anjay_heap_log"
+    };
+    esp_timer_handle_t timer;
+    if (esp_timer_create(&args, &timer) != ESP_OK) {
+        ESP_LOGW(TAG, "could not create the heap statistics log timer");
+        return;
+    }
+    if (esp_timer_start_periodic(
+                timer, (uint64_t) CONFIG_ANJAY_ESP_IDF_HEAP_STATS_LOG_INTERVAL_S
+                               * 1000000)
+            != ESP_OK) {
+        ESP_LOGW(TAG, "could not start the heap statistics log timer");
+        esp_timer_delete(timer);
+    }
+}
+#else  // CONFIG_ANJAY_ESP_IDF_HEAP_STATS_LOG_INTERVAL_S > 0
+static void ensure_log_timer_started(void) {}
+#endif // CONFIG_ANJAY_ESP_IDF_HEAP_STATS_LOG_INTERVAL_S > 0
+
+static block_header_t *header_of(void *ptr) {
+    return (block_header_t *) ((char *) ptr - HEADER_SIZE);
+}
+
+static void *tagged_realloc(anjay_esp_idf_heap_tag_t tag,
+                            void *ptr,
+                            size_t size) {
+    if (!size) {
+        avs_free(ptr);
+        return NULL;
+    }
+    if (size > UINT32_MAX - HEADER_SIZE) {
+        account_failure(tag);
+        return NULL;
+    }
+    block_header_t *old_header = ptr ? header_of(ptr) : NULL;
+    uint32_t old_size = 0;
+    if (old_header) {
+        // a block keeps the tag it has been allocated with
+        tag = (anjay_esp_idf_heap_tag_t) old_header->tag;
+        old_size = old_header->size;
+    }
+    block_header_t *header =
+            (block_header_t *) realloc(old_header, HEADER_SIZE + size);
+    if (!header) {
+        account_failure(tag);
+        return NULL;
+    }
+    header->size = (uint32_t) size;
+    header->tag = (uint32_t) tag;
+    account(tag, old_size, size, false, !old_header);
+    ensure_log_timer_started();
+    return (char *) header + HEADER_SIZE;
+}
+
+static void *tagged_malloc(anjay_esp_idf_heap_tag_t tag, size_t size) {
+    return tagged_realloc(tag, NULL, size ? size : 1);
+}
+
+static void *tagged_calloc(anjay_esp_idf_heap_tag_t tag,
+                           size_t nmemb,
+                           size_t size) {
+    if (size && nmemb > SIZE_MAX / size) {
+        account_failure(tag);
+        return NULL;
+    }
+    void *result = tagged_malloc(tag, nmemb * size);
+    if (result) {
+        memset(result, 0, nmemb * size);
+    }
+    return result;
+}
+
+void avs_free(void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    block_header_t *header = header_of(ptr);
+    account((anjay_esp_idf_heap_tag_t) header->tag, header->size, 0, true,
+            false);
+    free(header);
+}
+
+void *avs_malloc(size_t size) {
+    return tagged_malloc(ANJAY_ESP_IDF_HEAP_TAG_OTHER, size);
+}
+
+void *avs_calloc(size_t nmemb, size_t size) {
+    return tagged_calloc(ANJAY_ESP_IDF_HEAP_TAG_OTHER, nmemb, size);
+}
+
+void *avs_realloc(void *ptr, size_t size) {
+    return tagged_realloc(ANJAY_ESP_IDF_HEAP_TAG_OTHER, ptr, size);
+}
+
+/*
+ * Sources of each subsystem are compiled with avs_malloc, avs_calloc and
+ * avs_realloc defined to the variants below, see CMakeLists.txt.
+ */
+#define DEFINE_TAGGED_ALLOCATORS(Name, Tag)                                 \
+    void *_anjay_esp_idf_heap_malloc_##Name(size_t size);                   \
+    void *_anjay_esp_idf_heap_calloc_##Name(size_t nmemb, size_t size);     \
+    void *_anjay_esp_idf_heap_realloc_##Name(void *ptr, size_t size);       \
+                                                                            \
+    void *_anjay_esp_idf_heap_malloc_##Name(size_t size) {                  \
+        return tagged_malloc((Tag), size);                                  \
+    }                                                                       \
+                                                                            \
+    void *_anjay_esp_idf_heap_calloc_##Name(size_t nmemb, size_t size) {    \
+        return tagged_calloc((Tag), nmemb, size);                           \
+    }                                                                       \
+                                                                            \
+    void *_anjay_esp_idf_heap_realloc_##Name(void *ptr, size_t size) {      \
+        return tagged_realloc((Tag), ptr, size);                            \
+    }
+
+DEFINE_TAGGED_ALLOCATORS(anjay, ANJAY_ESP_IDF_HEAP_TAG_ANJAY)
+DEFINE_TAGGED_ALLOCATORS(anjay_dm, ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DM)
+DEFINE_TAGGED_ALLOCATORS(anjay_observe, ANJAY_ESP_IDF_HEAP_TAG_ANJAY_OBSERVE)
+DEFINE_TAGGED_ALLOCATORS(anjay_downloader,
+                         ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DOWNLOADER)
+DEFINE_TAGGED_ALLOCATORS(avs_coap, ANJAY_ESP_IDF_HEAP_TAG_AVS_COAP)
+DEFINE_TAGGED_ALLOCATORS(avs_commons, ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS)
+DEFINE_TAGGED_ALLOCATORS(avs_commons_net,
+                         ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_NET)
+DEFINE_TAGGED_ALLOCATORS(avs_commons_persistence,
+                         ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_PERSISTENCE)
+
+static void load_stats(anjay_esp_idf_heap_stats_t *out_stats,
+                       anjay_esp_idf_heap_stats_t *stats) {
+    out_stats->current_bytes =
+            __atomic_load_n(&stats->current_bytes, __ATOMIC_RELAXED);
+    out_stats->peak_bytes =
+            __atomic_load_n(&stats->peak_bytes, __ATOMIC_RELAXED);
+    out_stats->current_blocks =
+            __atomic_load_n(&stats->current_blocks, __ATOMIC_RELAXED);
+    out_stats->num_allocations =
+            __atomic_load_n(&stats->num_allocations, __ATOMIC_RELAXED);
+    out_stats->num_failed_allocations =
+            __atomic_load_n(&stats->num_failed_allocations, __ATOMIC_RELAXED);
+}
+
+void anjay_esp_idf_heap_stats_get(anjay_esp_idf_heap_stats_t *out_stats) {
+    load_stats(out_stats, &g_stats[ANJAY_ESP_IDF_HEAP_TAG_COUNT]);
+}
+
+int anjay_esp_idf_heap_stats_get_for_tag(
+        anjay_esp_idf_heap_tag_t tag, anjay_esp_idf_heap_stats_t *out_stats) {
+    if ((unsigned) tag >= ANJAY_ESP_IDF_HEAP_TAG_COUNT) {
+        return -1;
+    }
+    load_stats(out_stats, &g_stats[tag]);
+    return 0;
+}
+
+void anjay_esp_idf_heap_stats_reset_peak(void) {
+    for (size_t i = 0; i < AVS_ARRAY_SIZE(g_stats); ++i) {
+        __atomic_store_n(&g_stats[i].peak_bytes,
+                         __atomic_load_n(&g_stats[i].current_bytes,
+                                         __ATOMIC_RELAXED),
+                         __ATOMIC_RELAXED);
+    }
+}
+
+static const char *const TAG_NAMES[] = {
+    [ANJAY_ESP_IDF_HEAP_TAG_ANJAY] = "anjay",
+    [ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DM] = "anjay/dm",
+    [ANJAY_ESP_IDF_HEAP_TAG_ANJAY_OBSERVE] = "anjay/observe",
+    [ANJAY_ESP_IDF_HEAP_TAG_ANJAY_DOWNLOADER] = "anjay/downloader",
+    [ANJAY_ESP_IDF_HEAP_TAG_AVS_COAP] = "avs_coap",
+    [ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_NET] = "avs_commons/net",
+    [ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS_PERSISTENCE] =
+            "avs_commons/persistence",
+    [ANJAY_ESP_IDF_HEAP_TAG_AVS_COMMONS] = "avs_commons",
+    [ANJAY_ESP_IDF_HEAP_TAG_OTHER] = "other",
+    [ANJAY_ESP_IDF_HEAP_TAG_COUNT] = "total"
+};
+AVS_STATIC_ASSERT(AVS_ARRAY_SIZE(TAG_NAMES) == AVS_ARRAY_SIZE(g_stats),
+                  heap_tag_names_complete);
+
+void anjay_esp_idf_heap_stats_log(void) {
+    for (size_t i = 0; i < AVS_ARRAY_SIZE(g_stats); ++i) {
+        anjay_esp_idf_heap_stats_t stats;
+        load_stats(&stats, &g_stats[i]);
+        ESP_LOGI(TAG,
+                 "%s: current: %u B in %u blocks, peak: %u B, allocations: %u "
+                 "(%u failed)",
+                 TAG_NAMES[i], (unsigned) stats.current_bytes,
+                 (unsigned) stats.current_blocks, (unsigned) stats.peak_bytes,
+                 (unsigned) stats.num_allocations,
+                 (unsigned) stats.num_failed_allocations);
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2023-2026 AVSystem <avsystem@avsystem.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include <esp_timer.h>
+
+#include <avsystem/commons/avs_time.h>
+
+avs_time_real_t avs_time_real_now(void) {
+    struct timespec system_value;
+    avs_time_real_t result;
+    clock_gettime(CLOCK_REALTIME, &system_value);
+    result.since_real_epoch.seconds = system_value.tv_sec;
+    result.since_real_epoch.nanoseconds = (int32_t) system_value.tv_nsec;
+    return result;
+}
+
+/*
+ * esp_timer_get_time() reads the hardware timer directly, without going
+ * through the newlib clock_gettime() implementation. Its value is always
+ * non-negative, so plain division yields a normalized duration.
+ */
+avs_time_monotonic_t avs_time_monotonic_now(void) {
+    int64_t us = esp_timer_get_time();
+    avs_time_monotonic_t result;
+    result.since_monotonic_epoch.seconds = us / 1000000;
+    result.since_monotonic_epoch.nanoseconds = (int32_t) (us % 1000000) * 1000;
+    return result;
+}